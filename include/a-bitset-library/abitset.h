@@ -35,6 +35,10 @@ abitset_t * abitset_load(aml_pool_t *pool, uint64_t *repr, uint32_t size, bool m
 /* Checks if the bit at the given ID is enabled. Returns true if set, false otherwise. */
 bool abitset_enabled(abitset_t *h, uint32_t id);
 
+/* Checks n ids, storing in out[i] whether ids[i] is enabled.  Probes are prefetched ahead so that
+   their cache misses overlap.  See abitset_inline.h for inlinable versions of the single-bit ops. */
+void abitset_enabled_many(abitset_t *h, const uint32_t *ids, size_t n, bool *out);
+
 /* Sets the bit at the given ID to 1. */
 void abitset_set(abitset_t *h, uint32_t id);
 
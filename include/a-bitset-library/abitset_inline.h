@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2023–2025 Andy Curtis <contactandyc@gmail.com>
+// SPDX-FileCopyrightText: 2024–2025 Knode.ai — technical questions: contact Andy (above)
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef _abitset_inline_h
+#define _abitset_inline_h
+
+#include "a-bitset-library/abitset.h"
+
+/*
+ * Optional header which exposes the layout of `abitset_t` and provides static inline versions of the
+ * single-bit and word-access operations.  Include this instead of abitset.h in hot loops so that
+ * membership probes can be inlined by the compiler.  The layout is not part of the stable API, so code
+ * compiled against this header must be rebuilt alongside the library.
+ */
+
+struct abitset_s {
+    uint64_t *items;
+    uint64_t *ep;
+    uint64_t last_mask;
+    uint32_t size;
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+#define _abitset_prefetch_r(p) __builtin_prefetch((p), 0, 3)
+#define _abitset_prefetch_w(p) __builtin_prefetch((p), 1, 3)
+#else
+#define _abitset_prefetch_r(p) ((void)(p))
+#define _abitset_prefetch_w(p) ((void)(p))
+#endif
+
+/* How many ids ahead the batched probes prefetch */
+#ifndef ABITSET_PREFETCH_DISTANCE
+#define ABITSET_PREFETCH_DISTANCE 8
+#endif
+
+/* Returns the number of 64 bit words backing the bit set */
+static inline uint32_t abitset_words_inline(const abitset_t *h) {
+    return (uint32_t)(h->ep - h->items);
+}
+
+/* Returns the 64 bit word holding the given ID, or 0 if the ID is out of range. */
+static inline uint64_t abitset_word_inline(const abitset_t *h, uint32_t id) {
+    uint32_t block = id >> 6;
+    return block < abitset_words_inline(h) ? h->items[block] : 0;
+}
+
+/* Checks if the bit at the given ID is enabled. Returns true if set, false otherwise. */
+static inline bool abitset_enabled_inline(const abitset_t *h, uint32_t id) {
+    if(id >= h->size)
+        return false;
+    return (h->items[id >> 6] >> (id & 63)) & 1;
+}
+
+/* Sets the bit at the given ID to 1.  IDs beyond the size of the bit set are ignored. */
+static inline void abitset_set_inline(abitset_t *h, uint32_t id) {
+    if(id >= h->size)
+        return;
+    h->items[id >> 6] |= (1ULL << (id & 63));
+}
+
+/* Unsets the bit at the given ID (sets it to 0).  IDs beyond the size of the bit set are ignored. */
+static inline void abitset_unset_inline(abitset_t *h, uint32_t id) {
+    if(id >= h->size)
+        return;
+    h->items[id >> 6] &= ~(1ULL << (id & 63));
+}
+
+/* Sets or unsets the bit at the given ID based on the boolean value provided. */
+static inline void abitset_boolean_inline(abitset_t *h, uint32_t id, bool v) {
+    if(v)
+        abitset_set_inline(h, id);
+    else
+        abitset_unset_inline(h, id);
+}
+
+/* Prefetches the word holding the given ID for reading (no-op if the ID is out of range). */
+static inline void abitset_prefetch_inline(const abitset_t *h, uint32_t id) {
+    if(id < h->size)
+        _abitset_prefetch_r(h->items + (id >> 6));
+}
+
+/* Prefetches the word holding the given ID for writing (no-op if the ID is out of range). */
+static inline void abitset_prefetch_write_inline(const abitset_t *h, uint32_t id) {
+    if(id < h->size)
+        _abitset_prefetch_w(h->items + (id >> 6));
+}
+
+/* Shared prefetch-ahead pattern for the batched calls.  _abitset_prefetch_warm issues the first
+   ABITSET_PREFETCH_DISTANCE prefetches, and _abitset_prefetch_ahead is called before handling ids[i]
+   to keep the window ABITSET_PREFETCH_DISTANCE ids ahead. */
+static inline void _abitset_prefetch_warm(const abitset_t *h, const uint32_t *ids, size_t n, bool write) {
+    size_t warm = n < ABITSET_PREFETCH_DISTANCE ? n : ABITSET_PREFETCH_DISTANCE;
+    for(size_t i = 0; i < warm; i++) {
+        if(write)
+            abitset_prefetch_write_inline(h, ids[i]);
+        else
+            abitset_prefetch_inline(h, ids[i]);
+    }
+}
+
+static inline void _abitset_prefetch_ahead(const abitset_t *h, const uint32_t *ids, size_t n, size_t i,
+                                           bool write) {
+    if(i + ABITSET_PREFETCH_DISTANCE < n) {
+        if(write)
+            abitset_prefetch_write_inline(h, ids[i + ABITSET_PREFETCH_DISTANCE]);
+        else
+            abitset_prefetch_inline(h, ids[i + ABITSET_PREFETCH_DISTANCE]);
+    }
+}
+
+/* Probes n ids and stores whether each is enabled in out, prefetching ahead so that the cache
+   misses of independent probes overlap. */
+static inline void abitset_enabled_many_inline(const abitset_t *h, const uint32_t *ids, size_t n,
+                                               bool *out) {
+    _abitset_prefetch_warm(h, ids, n, false);
+    for(size_t i = 0; i < n; i++) {
+        _abitset_prefetch_ahead(h, ids, n, i, false);
+        out[i] = abitset_enabled_inline(h, ids[i]);
+    }
+}
+
+/* Counts how many of the n ids are enabled, prefetching ahead like abitset_enabled_many_inline. */
+static inline size_t abitset_count_many_inline(const abitset_t *h, const uint32_t *ids, size_t n) {
+    size_t count = 0;
+    _abitset_prefetch_warm(h, ids, n, false);
+    for(size_t i = 0; i < n; i++) {
+        _abitset_prefetch_ahead(h, ids, n, i, false);
+        count += abitset_enabled_inline(h, ids[i]);
+    }
+    return count;
+}
+
+/* Sets each of the n ids, prefetching ahead for write.  IDs beyond the size of the bit set are ignored. */
+static inline void abitset_set_many_inline(abitset_t *h, const uint32_t *ids, size_t n) {
+    _abitset_prefetch_warm(h, ids, n, true);
+    for(size_t i = 0; i < n; i++) {
+        _abitset_prefetch_ahead(h, ids, n, i, true);
+        abitset_set_inline(h, ids[i]);
+    }
+}
+
+#undef _abitset_prefetch_r
+#undef _abitset_prefetch_w
+
+#endif
@@ -4,13 +4,7 @@
 
 #include <assert.h>
 #include "a-bitset-library/abitset.h"
-
-struct abitset_s {
-    uint64_t *items;
-    uint64_t *ep;
-    uint64_t last_mask;
-    uint32_t size;
-};
+#include "a-bitset-library/abitset_inline.h"
 
 abitset_t *abitset_init(aml_pool_t *pool, uint32_t size) {
     // Calculate the number of blocks and the last mask
@@ -72,42 +66,26 @@ abitset_t *abitset_load(aml_pool_t *pool, uint64_t *repr, uint32_t size, bool ma
 }
 
 bool abitset_enabled(abitset_t *h, uint32_t id) {
-    uint32_t block = id >> 6;
-    uint32_t mask = id & 63;
-    uint64_t *p = h->items + block;
-    uint64_t *ep = h->ep;
-    if(p >= ep)
-        return false;
-    return (*p & (1ULL<<mask)) != 0 ? true : false;
+    return abitset_enabled_inline(h, id);
+}
+
+void abitset_enabled_many(abitset_t *h, const uint32_t *ids, size_t n, bool *out) {
+    abitset_enabled_many_inline(h, ids, n, out);
 }
 
 void abitset_set(abitset_t *h, uint32_t id) {
     assert(h && id < h->size);
-    uint32_t block = id >> 6;
-    uint32_t mask = id & 63;
-    uint64_t *p = h->items + block;
-    uint64_t *ep = h->ep;
-    if(p >= ep)
-        return;
-    *p |= (1ULL<<mask);
+    abitset_set_inline(h, id);
 }
 
 void abitset_unset(abitset_t *h, uint32_t id) {
     assert(h && id < h->size);
-    uint32_t block = id >> 6ULL;
-    uint32_t mask = id & 63ULL;
-    uint64_t *p = h->items + block;
-    uint64_t *ep = h->ep;
-    if(p >= ep)
-        return;
-    *p &= ~(1ULL<<mask);
+    abitset_unset_inline(h, id);
 }
 
 void abitset_boolean(abitset_t *h, uint32_t id, bool v) {
-    if(v)
-        abitset_set(h, id);
-    else
-        abitset_unset(h, id);
+    assert(h && id < h->size);
+    abitset_boolean_inline(h, id, v);
 }
 
 uint32_t abitset_count(abitset_t *h) {
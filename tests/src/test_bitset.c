@@ -5,6 +5,7 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include "a-bitset-library/abitset.h"
+#include "a-bitset-library/abitset_inline.h"
 
 int main(void) {
     // Create a memory pool for the bitset
@@ -48,6 +49,54 @@ int main(void) {
     int32_t first = abitset_first_enabled(bitset);
     printf("First enabled bit is at index: %d\n", first);
 
+    // Probe several bits at once (inline and out-of-line)
+    abitset_t *probe = abitset_init(pool, 200);
+    uint32_t ids[12] = { 0, 3, 64, 65, 127, 128, 150, 199, 200, 1000, 3, 64 };
+    bool out[12], out_inline[12];
+    abitset_set_many_inline(probe, ids, 8);
+    abitset_enabled_many(probe, ids, 12, out);
+    abitset_enabled_many_inline(probe, ids, 12, out_inline);
+    for(int i = 0; i < 12; i++) {
+        bool expected = ids[i] < 200;
+        if(out[i] != expected || out_inline[i] != expected ||
+           abitset_enabled_inline(probe, ids[i]) != abitset_enabled(probe, ids[i])) {
+            printf("Batched probe mismatch at id %u\n", ids[i]);
+            return 1;
+        }
+    }
+    abitset_unset_inline(probe, 64);
+    if(abitset_count_many_inline(probe, ids, 12) != 8 || abitset_word_inline(probe, 64) != ((1ULL << 63) | 2ULL) ||
+       abitset_words_inline(probe) != 4) {
+        printf("Inline word access mismatch\n");
+        return 1;
+    }
+    printf("Batched probes match single-bit probes.\n");
+
+    // Ids past the size (including padding bits in the last word) must be ignored
+    uint32_t before = abitset_count(probe);
+    uint32_t out_of_range[4] = { 200, 255, 256, 1000 };
+    abitset_set_inline(probe, 200);
+    abitset_set_inline(probe, 255);
+    abitset_boolean_inline(probe, 254, true);
+    abitset_set_many_inline(probe, out_of_range, 4);
+    if(abitset_count(probe) != before || abitset_word_inline(probe, 255) != (1ULL << (199 & 63))) {
+        printf("Out of range set changed the bitset\n");
+        return 1;
+    }
+
+    // Boolean toggles a bit on and off
+    abitset_boolean_inline(probe, 10, true);
+    if(!abitset_enabled_inline(probe, 10) || abitset_count(probe) != before + 1) {
+        printf("abitset_boolean_inline(true) failed\n");
+        return 1;
+    }
+    abitset_boolean_inline(probe, 10, false);
+    if(abitset_enabled_inline(probe, 10) || abitset_count(probe) != before) {
+        printf("abitset_boolean_inline(false) failed\n");
+        return 1;
+    }
+    printf("Inline setters respect the bitset size.\n");
+
     // Clean up
     aml_pool_destroy(pool);  // Assuming aml_pool_free cleans up all allocations
     printf("Cleaned up resources.\n");